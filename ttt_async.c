@@ -0,0 +1,406 @@
+// ttt_async.c — C23 asynchronous job API (work-stealing worker pool)
+// Implements the API in ttt_async.h
+
+#define _DEFAULT_SOURCE // eventfd(), write(), read()
+
+#include "ttt_async.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+// ------------------------- Jobs -------------------------
+/*
+   Jobs live in a fixed array of `capacity` slots. A slot is taken on submission
+   and returned only after its callback has been dispatched by ttt_async_poll(),
+   so the slot count bounds queued, running and unpolled jobs together.
+
+   Each slot's state word packs (generation << 8) | JOB_*; the generation is bumped
+   on every reuse so a stale handle can never cancel a newer job.
+*/
+enum { JOB_FREE,
+    JOB_QUEUED,
+    JOB_RUNNING,
+    JOB_CANCELLED,
+    JOB_DONE };
+
+typedef struct {
+    _Atomic uint64_t state;
+    uint32_t generation;
+    Board board;
+    ttt_move_callback callback;
+    void* user_data;
+    int move;
+    int status;
+} Job;
+
+static inline uint64_t job_state(uint32_t generation, unsigned state) { return ((uint64_t)generation << 8) | state; }
+static inline ttt_job job_handle(uint32_t generation, uint32_t slot) { return (ttt_job)(((uint64_t)generation << 32) | slot); }
+
+// ------------------------- Per-worker deques -------------------------
+
+// Bounded FIFO of job slots: submitters push at the bottom; the owner and thieves both
+// take from the top, so independent requests run in arrival order.
+typedef struct {
+    mtx_t lock;
+    uint32_t* ring;
+    size_t top;
+    size_t count;
+} Deque;
+
+typedef struct {
+    thrd_t thread;
+    ttt_cache* cache; // private scratch table, allocated once and reset per job
+    Deque deque;
+    unsigned index;
+} Worker;
+
+typedef struct {
+    bool running;
+    bool sync_ready; // lock/wake initialised
+    bool stopping; // guarded by lock
+    size_t capacity;
+    Job* jobs;
+
+    mtx_t lock; // guards free list, completion ring and worker sleep
+    cnd_t wake;
+    uint32_t* free_slots;
+    size_t free_count;
+    uint32_t* done_ring;
+    size_t done_top;
+    size_t done_count;
+
+    atomic_long queued; // jobs sitting in deques (may dip below zero transiently)
+    atomic_uint next_worker;
+    Worker* workers;
+    unsigned worker_count;
+    int event_fd;
+} Pool;
+
+static Pool pool = { .event_fd = -1 };
+
+static void deque_push(Deque* deque, uint32_t slot)
+{
+    mtx_lock(&deque->lock);
+    // Never full: a deque holds at most `capacity` slots.
+    deque->ring[(deque->top + deque->count) % pool.capacity] = slot;
+    ++deque->count;
+    mtx_unlock(&deque->lock);
+}
+
+static bool deque_take(Deque* deque, uint32_t* out_slot)
+{
+    mtx_lock(&deque->lock);
+    bool found = deque->count > 0;
+    if (found) {
+        *out_slot = deque->ring[deque->top];
+        deque->top = (deque->top + 1) % pool.capacity;
+        --deque->count;
+    }
+    mtx_unlock(&deque->lock);
+    return found;
+}
+
+// ------------------------- Completion queue -------------------------
+
+static void signal_event(void)
+{
+#if defined(__linux__)
+    uint64_t one = 1;
+    ssize_t written = write(pool.event_fd, &one, sizeof one);
+    (void)written; // counter saturation only means "already readable"
+#endif
+}
+
+static void clear_event(void)
+{
+#if defined(__linux__)
+    uint64_t value;
+    ssize_t got = read(pool.event_fd, &value, sizeof value);
+    (void)got; // EAGAIN when nothing was signalled
+#endif
+}
+
+static void post_completion(uint32_t slot)
+{
+    mtx_lock(&pool.lock);
+    pool.done_ring[(pool.done_top + pool.done_count) % pool.capacity] = slot;
+    ++pool.done_count;
+    mtx_unlock(&pool.lock);
+    signal_event();
+}
+
+// ------------------------- Workers -------------------------
+
+static bool take_job(Worker* self, uint32_t* out_slot)
+{
+    if (deque_take(&self->deque, out_slot))
+        return true;
+    for (unsigned k = 1; k < pool.worker_count; ++k) {
+        Worker* victim = &pool.workers[(self->index + k) % pool.worker_count];
+        if (deque_take(&victim->deque, out_slot))
+            return true;
+    }
+    return false;
+}
+
+static void run_job(Worker* self, uint32_t slot)
+{
+    Job* job = &pool.jobs[slot];
+    uint64_t expected = job_state(job->generation, JOB_QUEUED);
+    if (atomic_compare_exchange_strong(&job->state, &expected, job_state(job->generation, JOB_RUNNING))) {
+        // TT entries are α-β bounds with ply-dependent scores, valid only within one
+        // search tree; reset so the answer never depends on what this worker ran before.
+        ttt_cache_reset(self->cache);
+        job->move = ttt_best_move_with(self->cache, job->board);
+        job->status = TTT_ASYNC_OK;
+    } else {
+        job->move = -1;
+        job->status = TTT_ASYNC_CANCELLED;
+    }
+    atomic_store(&job->state, job_state(job->generation, JOB_DONE));
+    post_completion(slot);
+}
+
+static int worker_main(void* arg)
+{
+    Worker* self = arg;
+    for (;;) {
+        uint32_t slot;
+        if (take_job(self, &slot)) {
+            atomic_fetch_sub(&pool.queued, 1);
+            run_job(self, slot);
+            continue;
+        }
+        mtx_lock(&pool.lock);
+        while (atomic_load(&pool.queued) <= 0 && !pool.stopping)
+            cnd_wait(&pool.wake, &pool.lock);
+        bool done = pool.stopping && atomic_load(&pool.queued) <= 0;
+        mtx_unlock(&pool.lock);
+        if (done)
+            return 0;
+    }
+}
+
+// ------------------------- Public API -------------------------
+
+static void release_pool(void)
+{
+    for (unsigned i = 0; i < pool.worker_count; ++i) {
+        ttt_cache_destroy(pool.workers[i].cache);
+        free(pool.workers[i].deque.ring);
+        mtx_destroy(&pool.workers[i].deque.lock);
+    }
+    free(pool.workers);
+    free(pool.jobs);
+    free(pool.free_slots);
+    free(pool.done_ring);
+    if (pool.sync_ready) {
+        cnd_destroy(&pool.wake);
+        mtx_destroy(&pool.lock);
+    }
+#if defined(__linux__)
+    if (pool.event_fd >= 0)
+        close(pool.event_fd);
+#endif
+    pool = (Pool) { .event_fd = -1 };
+}
+
+int ttt_async_init(unsigned workers, size_t capacity)
+{
+    if (pool.running || workers == 0 || capacity == 0 || capacity > UINT32_MAX)
+        return TTT_ASYNC_ERROR;
+
+    pool.capacity = capacity;
+    pool.jobs = calloc(capacity, sizeof *pool.jobs);
+    pool.free_slots = calloc(capacity, sizeof *pool.free_slots);
+    pool.done_ring = calloc(capacity, sizeof *pool.done_ring);
+    pool.workers = calloc(workers, sizeof *pool.workers);
+    if (!pool.jobs || !pool.free_slots || !pool.done_ring || !pool.workers)
+        return (release_pool(), TTT_ASYNC_NO_MEMORY);
+    if (mtx_init(&pool.lock, mtx_plain) != thrd_success)
+        return (release_pool(), TTT_ASYNC_ERROR);
+    if (cnd_init(&pool.wake) != thrd_success) {
+        mtx_destroy(&pool.lock);
+        return (release_pool(), TTT_ASYNC_ERROR);
+    }
+    pool.sync_ready = true;
+
+    for (size_t i = 0; i < capacity; ++i) {
+        pool.jobs[i].generation = 1u;
+        pool.free_slots[i] = (uint32_t)(capacity - 1u - i); // hand out slot 0 first
+    }
+    pool.free_count = capacity;
+    atomic_init(&pool.queued, 0);
+    atomic_init(&pool.next_worker, 0u);
+
+    for (unsigned i = 0; i < workers; ++i) {
+        Worker* worker = &pool.workers[i];
+        worker->index = i;
+        worker->cache = ttt_cache_create();
+        worker->deque.ring = calloc(capacity, sizeof *worker->deque.ring);
+        if (mtx_init(&worker->deque.lock, mtx_plain) != thrd_success) {
+            ttt_cache_destroy(worker->cache);
+            free(worker->deque.ring);
+            return (release_pool(), TTT_ASYNC_ERROR);
+        }
+        pool.worker_count = i + 1u; // release_pool() tears down workers [0, worker_count)
+        if (!worker->cache || !worker->deque.ring)
+            return (release_pool(), TTT_ASYNC_NO_MEMORY);
+    }
+
+#if defined(__linux__)
+    pool.event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+
+    for (unsigned i = 0; i < workers; ++i) {
+        if (thrd_create(&pool.workers[i].thread, worker_main, &pool.workers[i]) != thrd_success) {
+            // Stop the threads already started, then unwind.
+            mtx_lock(&pool.lock);
+            pool.stopping = true;
+            cnd_broadcast(&pool.wake);
+            mtx_unlock(&pool.lock);
+            for (unsigned k = 0; k < i; ++k)
+                thrd_join(pool.workers[k].thread, NULL);
+            release_pool();
+            return TTT_ASYNC_ERROR;
+        }
+    }
+
+    pool.running = true;
+    return TTT_ASYNC_OK;
+}
+
+void ttt_async_shutdown(void)
+{
+    if (!pool.running)
+        return;
+
+    // Cancel everything still queued; workers drain the deques as cancellations.
+    for (size_t i = 0; i < pool.capacity; ++i) {
+        Job* job = &pool.jobs[i];
+        uint64_t expected = job_state(job->generation, JOB_QUEUED);
+        atomic_compare_exchange_strong(&job->state, &expected, job_state(job->generation, JOB_CANCELLED));
+    }
+
+    mtx_lock(&pool.lock);
+    pool.stopping = true;
+    cnd_broadcast(&pool.wake);
+    mtx_unlock(&pool.lock);
+    for (unsigned i = 0; i < pool.worker_count; ++i)
+        thrd_join(pool.workers[i].thread, NULL);
+
+    ttt_async_poll(SIZE_MAX); // every submitted job gets exactly one callback
+    release_pool();
+}
+
+ttt_job ttt_submit_best_move(Board board, ttt_move_callback callback, void* user_data)
+{
+    if (!pool.running)
+        return TTT_ASYNC_NOT_RUNNING;
+    if (!callback)
+        return TTT_ASYNC_ERROR;
+
+    // Backpressure: no free slot means the caller must poll before submitting more.
+    // Once shutdown starts (including from a callback it dispatches), refuse new work:
+    // the workers may already be joined and nothing would run its callback.
+    mtx_lock(&pool.lock);
+    bool stopping = pool.stopping;
+    bool have_slot = !stopping && pool.free_count > 0;
+    uint32_t slot = have_slot ? pool.free_slots[--pool.free_count] : 0u;
+    mtx_unlock(&pool.lock);
+    if (stopping)
+        return TTT_ASYNC_NOT_RUNNING;
+    if (!have_slot)
+        return TTT_ASYNC_FULL;
+
+    Job* job = &pool.jobs[slot];
+    job->board = board;
+    job->callback = callback;
+    job->user_data = user_data;
+    atomic_store(&job->state, job_state(job->generation, JOB_QUEUED));
+    ttt_job handle = job_handle(job->generation, slot);
+
+    unsigned target = atomic_fetch_add(&pool.next_worker, 1u) % pool.worker_count;
+    deque_push(&pool.workers[target].deque, slot);
+
+    mtx_lock(&pool.lock);
+    atomic_fetch_add(&pool.queued, 1);
+    cnd_signal(&pool.wake);
+    mtx_unlock(&pool.lock);
+    return handle;
+}
+
+bool ttt_cancel(ttt_job job)
+{
+    if (!pool.running || job <= 0)
+        return false;
+    uint32_t slot = (uint32_t)((uint64_t)job & 0xFFFFFFFFu);
+    uint32_t generation = (uint32_t)((uint64_t)job >> 32);
+    if (slot >= pool.capacity)
+        return false;
+    uint64_t expected = job_state(generation, JOB_QUEUED);
+    return atomic_compare_exchange_strong(&pool.jobs[slot].state, &expected, job_state(generation, JOB_CANCELLED));
+}
+
+size_t ttt_async_poll(size_t max)
+{
+    if (!pool.running)
+        return 0;
+
+    // Clear first: anything posted after this read re-arms the fd.
+    clear_event();
+
+    size_t ran = 0;
+    while (ran < max) {
+        mtx_lock(&pool.lock);
+        if (pool.done_count == 0) {
+            mtx_unlock(&pool.lock);
+            break;
+        }
+        uint32_t slot = pool.done_ring[pool.done_top];
+        pool.done_top = (pool.done_top + 1) % pool.capacity;
+        --pool.done_count;
+        mtx_unlock(&pool.lock);
+
+        Job* job = &pool.jobs[slot];
+        ttt_job handle = job_handle(job->generation, slot);
+        ttt_move_callback callback = job->callback;
+        void* user_data = job->user_data;
+        int move = job->move, status = job->status;
+
+        // Recycle the slot before the callback so it may submit follow-up work.
+        job->generation = job->generation < INT32_MAX ? job->generation + 1u : 1u;
+        atomic_store(&job->state, job_state(job->generation, JOB_FREE));
+        mtx_lock(&pool.lock);
+        pool.free_slots[pool.free_count++] = slot;
+        mtx_unlock(&pool.lock);
+
+        callback(handle, move, status, user_data);
+        ++ran;
+    }
+
+    mtx_lock(&pool.lock);
+    bool pending = pool.done_count > 0;
+    mtx_unlock(&pool.lock);
+    if (pending)
+        signal_event();
+    return ran;
+}
+
+size_t ttt_async_pending(void)
+{
+    if (!pool.running)
+        return 0;
+    mtx_lock(&pool.lock);
+    size_t pending = pool.done_count;
+    mtx_unlock(&pool.lock);
+    return pending;
+}
+
+int ttt_async_fd(void) { return pool.running ? pool.event_fd : -1; }
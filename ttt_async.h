@@ -0,0 +1,67 @@
+// ttt_async.h — C23 asynchronous job API over the tic-tac-toe engine
+#ifndef TTT_ASYNC_H
+#define TTT_ASYNC_H
+
+#include "ttt_engine.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Job handle returned by ttt_submit_best_move() (positive when valid).
+typedef int64_t ttt_job;
+
+/// Status codes for the async API (also passed to completion callbacks).
+enum {
+    TTT_ASYNC_OK = 0,
+    TTT_ASYNC_CANCELLED = -1, ///< Job was cancelled before it ran.
+    TTT_ASYNC_FULL = -2, ///< Queue is at capacity; poll completions and retry.
+    TTT_ASYNC_NOT_RUNNING = -3, ///< Pool not initialised, shutting down, or shut down.
+    TTT_ASYNC_NO_MEMORY = -4,
+    TTT_ASYNC_ERROR = -5, ///< Already running, bad argument, or thread start failure.
+};
+
+/**
+ * @brief Completion callback, invoked from ttt_async_poll() on the polling thread.
+ * @param job       Handle returned at submission.
+ * @param move      Best move (as ttt_best_move()), or -1 if cancelled.
+ * @param status    TTT_ASYNC_OK or TTT_ASYNC_CANCELLED.
+ * @param user_data Pointer passed at submission.
+ */
+typedef void (*ttt_move_callback)(ttt_job job, int move, int status, void* user_data);
+
+/**
+ * @brief Start the worker pool. Each worker owns an engine cache, allocated once and
+ *        cleared before every job (results match ttt_best_move() on a fresh cache),
+ *        and steals queued jobs from the other workers when idle.
+ * @param workers  Number of worker threads (>= 1).
+ * @param capacity Maximum jobs in flight, counting completions not yet polled (>= 1).
+ * @return TTT_ASYNC_OK or a negative TTT_ASYNC_* code.
+ */
+int ttt_async_init(unsigned workers, size_t capacity);
+
+/// Stop the pool: cancel queued jobs, wait for running ones, dispatch every pending callback.
+void ttt_async_shutdown(void);
+
+/**
+ * @brief Queue a best-move search for @p board; never blocks.
+ * @return Job handle (> 0), or TTT_ASYNC_FULL / TTT_ASYNC_NOT_RUNNING / TTT_ASYNC_ERROR.
+ */
+[[nodiscard]] ttt_job ttt_submit_best_move(Board board, ttt_move_callback callback, void* user_data);
+
+/// Cancel @p job if it has not started; its callback then reports TTT_ASYNC_CANCELLED.
+bool ttt_cancel(ttt_job job);
+
+/// Invoke callbacks for up to @p max finished jobs on the calling thread; return how many ran.
+size_t ttt_async_poll(size_t max);
+
+/// Number of finished jobs whose callbacks are waiting for ttt_async_poll().
+size_t ttt_async_pending(void);
+
+/// File descriptor that is readable while completions are pending (Linux eventfd), or -1.
+int ttt_async_fd(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // TTT_ASYNC_H
@@ -5,6 +5,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+enum { NOTAKTO_MAX_BOARDS = 64,
+    NOTAKTO_PER_ROW = 8,
+    NOTAKTO_CELL_WIDTH = 12 };
+
 static void show_board(Board board)
 {
     uint16_t x_bits = ttt_bits_x(board), o_bits = ttt_bits_o(board);
@@ -33,8 +37,9 @@ static int read_move(void)
 
 static void usage(const char* program_name)
 {
-    fprintf(stderr, "Usage: %s [--ai X|O|none]\n", program_name);
+    fprintf(stderr, "Usage: %s [--ai X|O|none] [--notakto BOARDS]\n", program_name);
     fprintf(stderr, "Enter moves as 0..8 or algebraic a1..c3 (a1=top-left)\n");
+    fprintf(stderr, "Notakto: enter the board number first, e.g. '2 b2'; --ai X moves first\n");
 }
 
 static int get_human_move(Board board)
@@ -62,9 +67,10 @@ static int get_human_move(Board board)
     }
 }
 
-static int parse_cli_arguments(int argc, const char* const* argv, ttt_side* ai_player)
+static int parse_cli_arguments(int argc, const char* const* argv, ttt_side* ai_player, int* notakto_boards)
 {
     *ai_player = (ttt_side)2; // Default to NONE
+    *notakto_boards = 0; // Default to classic tic-tac-toe
 
     for (int i = 1; i < argc; ++i) {
         if (strcmp(argv[i], "--ai") == 0) {
@@ -78,6 +84,15 @@ static int parse_cli_arguments(int argc, const char* const* argv, ttt_side* ai_p
             } else if (value[0] == 'n' || value[0] == 'N') { /* human vs human, ai_player remains NONE */
             } else
                 return (usage(argv[0]), 1);
+        } else if (strcmp(argv[i], "--notakto") == 0) {
+            if (i + 1 >= argc)
+                return (usage(argv[0]), 1);
+            const char* value = argv[++i];
+            char* end_ptr = NULL;
+            long count = strtol(value, &end_ptr, 10);
+            if (end_ptr == value || *end_ptr != '\0' || count < 1 || count > NOTAKTO_MAX_BOARDS)
+                return (usage(argv[0]), 1);
+            *notakto_boards = (int)count;
         } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
             return (usage(argv[0]), 0);
         } else {
@@ -128,13 +143,111 @@ static int run_game(ttt_side ai_player)
     return 0;
 }
 
+// ------------------------- Notakto -------------------------
+
+static void show_notakto(const Board* boards, int count)
+{
+    // Every line of a board cell is NOTAKTO_CELL_WIDTH columns, so labels stay above their board.
+    for (int first = 0; first < count; first += NOTAKTO_PER_ROW) {
+        int last = first + NOTAKTO_PER_ROW < count ? first + NOTAKTO_PER_ROW : count;
+        puts("");
+        for (int b = first; b < last; ++b) {
+            char label[32];
+            snprintf(label, sizeof label, "#%d%s", b + 1, ttt_nk_is_dead(boards[b]) ? " dead" : "");
+            printf("%-*s", NOTAKTO_CELL_WIDTH, label);
+        }
+        puts("");
+        for (int b = first; b < last; ++b)
+            printf("   a b c    "); // Column coordinates
+        puts("");
+        for (int r = 0; r < 3; ++r) {
+            for (int b = first; b < last; ++b) {
+                printf(" %d", r + 1); // Row coordinate
+                for (int c = 0; c < 3; ++c)
+                    printf(" %c", (ttt_bits_x(boards[b]) & (1u << (r * 3 + c))) ? 'X' : '.');
+                printf("    ");
+            }
+            puts("");
+        }
+    }
+}
+
+static int get_notakto_move(const Board* boards, int count, int player, size_t* out_board)
+{
+    while (true) {
+        printf("\nPlayer %d, your move (board and square, e.g. '1 b2'): ", player);
+        fflush(stdout);
+        char buf[64];
+        if (!fgets(buf, sizeof buf, stdin))
+            return -1; // Internal EOF signal
+        char* rest = NULL;
+        long board = strtol(buf, &rest, 10);
+        if (rest == buf || board < 1 || board > count) {
+            fprintf(stderr, "Invalid board. Enter a board number 1-%d first.\n", count);
+            continue;
+        }
+        int move = ttt_parse_move(rest);
+        if (move < 0) {
+            fprintf(stderr, "Invalid square. Enter 0-8 or a1-c3 after the board number.\n");
+            continue;
+        }
+        if (ttt_nk_is_dead(boards[board - 1]) || !ttt_is_empty(boards[board - 1], move)) {
+            fprintf(stderr, "Illegal move (board dead or square occupied).\n");
+            continue;
+        }
+        *out_board = (size_t)(board - 1);
+        return move;
+    }
+}
+
+static int run_notakto(ttt_side ai_player, int count)
+{
+    Board boards[NOTAKTO_MAX_BOARDS] = { 0 };
+    bool ai_active = (ai_player != (ttt_side)2);
+    int player = 0; // 0 = first player, 1 = second player
+
+    printf("Welcome to Notakto on %d board%s! Completing the last three-in-a-row loses.\n", count, count == 1 ? "" : "s");
+
+    while (true) {
+        show_notakto(boards, count);
+
+        if (ttt_nk_is_over(boards, (size_t)count)) {
+            printf("\n--- GAME OVER ---\n");
+            printf("Player %d wins!\n", player + 1);
+            printf("-----------------\n");
+            break;
+        }
+
+        size_t board = 0;
+        int move = -1;
+        if (ai_active && player == (int)ai_player) {
+            printf("\nAI is playing...\n");
+            move = ttt_nk_best_move(boards, (size_t)count, &board);
+            printf("AI played on board %zu square %d\n", board + 1, move);
+        } else {
+            move = get_notakto_move(boards, count, player + 1, &board);
+            if (move == -1) { // EOF or read error
+                printf("\nExiting game.\n");
+                break;
+            }
+        }
+
+        boards[board] = ttt_nk_apply(boards[board], move);
+        player ^= 1;
+    }
+    return 0;
+}
+
 int main(int argc, const char* const* argv)
 {
     ttt_side ai = (ttt_side)2; // 2 == NONE here in CLI
+    int notakto_boards = 0;
 
-    if (parse_cli_arguments(argc, argv, &ai) != 0) {
+    if (parse_cli_arguments(argc, argv, &ai, &notakto_boards) != 0) {
         return 1; // Error during argument parsing or help requested
     }
 
+    if (notakto_boards > 0)
+        return run_notakto(ai, notakto_boards);
     return run_game(ai);
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <limits.h>
 #include <stdalign.h>
 #include <stdlib.h>
+#include <threads.h>
 
 static_assert(sizeof(uint16_t) * 8 >= 9, "bitfield needs at least 9 bits");
 
@@ -124,7 +125,13 @@ typedef struct {
 
 // 19-bit key space; canonicalization reduces distinct states substantially.
 #define TT_SIZE (1u << 19)
-static alignas(64) TTEntry TT[TT_SIZE];
+
+struct ttt_cache {
+    alignas(64) TTEntry entries[TT_SIZE];
+};
+
+// Cache behind the synchronous ttt_best_move().
+static ttt_cache TT;
 
 static inline uint32_t key_from(Board board)
 {
@@ -132,12 +139,24 @@ static inline uint32_t key_from(Board board)
     return (uint32_t)canonical(board) & (TT_SIZE - 1u);
 }
 
-void ttt_reset_cache(void)
+ttt_cache* ttt_cache_create(void)
+{
+    ttt_cache* cache = aligned_alloc(alignof(ttt_cache), sizeof(ttt_cache));
+    if (cache)
+        ttt_cache_reset(cache);
+    return cache;
+}
+
+void ttt_cache_destroy(ttt_cache* cache) { free(cache); }
+
+void ttt_cache_reset(ttt_cache* cache)
 {
     for (size_t i = 0; i < TT_SIZE; ++i)
-        TT[i].seen = 0;
+        cache->entries[i].seen = 0;
 }
 
+void ttt_reset_cache(void) { ttt_cache_reset(&TT); }
+
 // ------------------------- Move ordering -------------------------
 
 // Center, corners, edges
@@ -148,9 +167,9 @@ static const int ORDER[9] = { 4, 0, 2, 6, 8, 1, 3, 5, 7 };
 static inline ttt_score win_in(int ply) { return TTT_WIN - ply; }
 static inline ttt_score lose_in(int ply) { return TTT_LOSS + ply; }
 
-static ttt_score search(Board board, ttt_score alpha, ttt_score beta, int ply)
+static ttt_score search(ttt_cache* cache, Board board, ttt_score alpha, ttt_score beta, int ply)
 {
-    TTEntry* entry = &TT[key_from(board)];
+    TTEntry* entry = &cache->entries[key_from(board)];
     if (entry->seen)
         return entry->score;
 
@@ -173,7 +192,7 @@ static ttt_score search(Board board, ttt_score alpha, ttt_score beta, int ply)
         // If this creates a win for the mover now, return quick mate score.
         ttt_score score = ttt_is_win_bits((ttt_side_to_move(board) == TTT_X) ? ttt_bits_x(new_board) : ttt_bits_o(new_board))
             ? win_in(ply)
-            : -(search(new_board, -beta, -alpha, ply + 1));
+            : -(search(cache, new_board, -beta, -alpha, ply + 1));
         entry->seen = 1u;
         entry->score = (int8_t)score;
         return score;
@@ -200,7 +219,7 @@ static ttt_score search(Board board, ttt_score alpha, ttt_score beta, int ply)
             return a;
         }
 
-        ttt_score score = -(search(new_board, -beta, -a, ply + 1));
+        ttt_score score = -(search(cache, new_board, -beta, -a, ply + 1));
         if (score > a) {
             a = score;
             if (a >= beta) {
@@ -237,7 +256,9 @@ bool ttt_is_terminal(Board board, ttt_score* out_score)
     return false;
 }
 
-int ttt_best_move(Board board)
+int ttt_best_move(Board board) { return ttt_best_move_with(&TT, board); }
+
+int ttt_best_move_with(ttt_cache* cache, Board board)
 {
     // Fast-path guard: if terminal or no empties, no move to make
     if ((ttt_bits_occ(board) == FULL9) || ttt_is_win_bits(ttt_bits_x(board)) || ttt_is_win_bits(ttt_bits_o(board))) {
@@ -269,7 +290,7 @@ int ttt_best_move(Board board)
         // If this wins immediately, prefer it
         ttt_score score = ttt_is_win_bits((ttt_side_to_move(board) == TTT_X) ? ttt_bits_x(new_board) : ttt_bits_o(new_board))
             ? win_in(0)
-            : -(search(new_board, INT_MIN / 2, INT_MAX / 2, 1));
+            : -(search(cache, new_board, INT_MIN / 2, INT_MAX / 2, 1));
 
         if (score > best_score) {
             best_score = score;
@@ -280,6 +301,180 @@ int ttt_best_move(Board board)
     return best_square; // Should be valid due to the fast-path guard
 }
 
+// ------------------------- Notakto (misère quotient) -------------------------
+/*
+   Single-board Notakto positions reduce to the 18-element misère quotient
+     Q = < a, b, c, d | a² = 1, b³ = b, b²c = c, c³ = ac², b²d = d, cd = ad, d² = c² >
+   with P-positions { a, b², bc, c² }. An element a^i b^j c^k d^l is packed as
+   i in bit 0, j in bits 1..2, k in bits 3..4, l in bit 5.
+*/
+enum {
+    NK_1 = 0,
+    NK_A = 1,
+    NK_B = 2,
+    NK_AB = 3,
+    NK_BB = 4,
+    NK_BC = 10,
+    NK_C = 8,
+    NK_CC = 16,
+    NK_D = 32,
+    NK_AD = 33,
+};
+
+// Canonical (under D4) live boards and their quotient elements.
+static const struct {
+    uint16_t bits;
+    ttt_nk_value value;
+} NK_SEEDS[] = {
+    { 0000, NK_C },
+    { 0001, NK_1 }, { 0002, NK_1 }, { 0142, NK_1 },
+    { 0003, NK_D },
+    { 0005, NK_B }, { 0013, NK_B }, { 0014, NK_B }, { 0021, NK_B },
+    { 0022, NK_B }, { 0035, NK_B }, { 0036, NK_B }, { 0052, NK_B },
+    { 0055, NK_B }, { 0143, NK_B }, { 0145, NK_B }, { 0156, NK_B },
+    { 0161, NK_B }, { 0162, NK_B }, { 0253, NK_B },
+    { 0012, NK_A }, { 0015, NK_A }, { 0025, NK_A }, { 0033, NK_A },
+    { 0034, NK_A }, { 0050, NK_A }, { 0053, NK_A }, { 0104, NK_A },
+    { 0141, NK_A }, { 0146, NK_A }, { 0154, NK_A }, { 0163, NK_A },
+    { 0252, NK_A }, { 0255, NK_A }, { 0345, NK_A }, { 0356, NK_A },
+    { 0505, NK_A },
+    { 0016, NK_AD }, { 0051, NK_AD }, { 0106, NK_AD },
+    { 0020, NK_CC },
+    { 0023, NK_AB }, { 0032, NK_AB }, { 0105, NK_AB }, { 0116, NK_AB },
+    { 0152, NK_AB },
+};
+
+// Quotient element for every 9-bit X pattern, filled once from NK_SEEDS.
+static ttt_nk_value NK_VALUE[1u << 9];
+static once_flag nk_once = ONCE_FLAG_INIT;
+
+static void nk_init(void)
+{
+    for (uint16_t bits = 0; bits <= FULL9; ++bits) {
+        NK_VALUE[bits] = NK_1;
+        if (ttt_is_win_bits(bits))
+            continue;
+        uint16_t key = ttt_bits_x(canonical((Board)bits));
+        for (size_t i = 0; i < sizeof NK_SEEDS / sizeof NK_SEEDS[0]; ++i) {
+            if (NK_SEEDS[i].bits == key) {
+                NK_VALUE[bits] = NK_SEEDS[i].value;
+                break;
+            }
+        }
+    }
+}
+
+ttt_nk_value ttt_nk_board_value(Board board)
+{
+    call_once(&nk_once, nk_init);
+    return NK_VALUE[ttt_bits_x(board)];
+}
+
+ttt_nk_value ttt_nk_mul(ttt_nk_value lhs, ttt_nk_value rhs)
+{
+    unsigned a = (lhs & 1u) + (rhs & 1u);
+    unsigned b = ((lhs >> 1) & 3u) + ((rhs >> 1) & 3u);
+    unsigned c = ((lhs >> 3) & 3u) + ((rhs >> 3) & 3u);
+    unsigned d = ((lhs >> 5) & 1u) + ((rhs >> 5) & 1u);
+
+    // Rewrite to normal form: b <= 2, c <= 2, d <= 1, never c·d, b² only alone.
+    for (;;) {
+        if (b >= 3u) {
+            b -= 2u; // b³ = b
+        } else if (b == 2u && (c || d)) {
+            b = 0u; // b²c = c, b²d = d
+        } else if (c && d) {
+            --c; // cd = ad
+            ++a;
+        } else if (d >= 2u) {
+            d -= 2u; // d² = c²
+            c += 2u;
+        } else if (c >= 3u) {
+            --c; // c³ = ac²
+            ++a;
+        } else {
+            break;
+        }
+    }
+    return (ttt_nk_value)((a & 1u) | (b << 1) | (c << 3) | (d << 5));
+}
+
+ttt_nk_value ttt_nk_value_of(const Board* boards, size_t count)
+{
+    ttt_nk_value value = NK_1;
+    for (size_t i = 0; i < count; ++i)
+        value = ttt_nk_mul(value, ttt_nk_board_value(boards[i]));
+    return value;
+}
+
+bool ttt_nk_is_p(ttt_nk_value value)
+{
+    return value == NK_A || value == NK_BB || value == NK_BC || value == NK_CC;
+}
+
+bool ttt_nk_is_over(const Board* boards, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        if (!ttt_nk_is_dead(boards[i]))
+            return false;
+    return true;
+}
+
+int ttt_nk_best_move(const Board* boards, size_t count, size_t* out_board)
+{
+    // rest[v] = product of all boards except one board of value v. Single boards
+    // take only a handful of distinct values, so this stays O(count).
+    ttt_nk_value rest[64];
+    uint64_t done = 0;
+    for (size_t i = 0; i < count; ++i) {
+        ttt_nk_value v = ttt_nk_board_value(boards[i]);
+        if (done & (1ull << v))
+            continue;
+        done |= 1ull << v;
+        ttt_nk_value product = NK_1;
+        for (size_t j = 0; j < count; ++j)
+            if (j != i)
+                product = ttt_nk_mul(product, ttt_nk_board_value(boards[j]));
+        rest[v] = product;
+    }
+
+    // Winning move: leave the opponent a P-position.
+    int fallback_square = -1, quiet_square = -1;
+    size_t fallback_board = 0, quiet_board = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (ttt_nk_is_dead(boards[i]))
+            continue;
+        ttt_nk_value others = rest[ttt_nk_board_value(boards[i])];
+        uint16_t empty_squares = (uint16_t)(~ttt_bits_occ(boards[i]) & FULL9);
+        for (int k = 0; k < 9; ++k) {
+            int square = ORDER[k];
+            if ((empty_squares & (1u << square)) == 0u)
+                continue;
+            Board new_board = ttt_nk_apply(boards[i], square);
+            if (ttt_nk_is_p(ttt_nk_mul(others, ttt_nk_board_value(new_board)))) {
+                *out_board = i;
+                return square;
+            }
+            if (fallback_square < 0) {
+                fallback_square = square;
+                fallback_board = i;
+            }
+            if (quiet_square < 0 && !ttt_nk_is_dead(new_board)) {
+                quiet_square = square;
+                quiet_board = i;
+            }
+        }
+    }
+
+    // Lost position: prefer a move that keeps the board alive, to prolong the game.
+    if (quiet_square >= 0) {
+        *out_board = quiet_board;
+        return quiet_square;
+    }
+    *out_board = fallback_board;
+    return fallback_square;
+}
+
 // ------------------------- Utilities -------------------------
 
 int ttt_parse_move(const char* str)
@@ -103,6 +103,66 @@ bool ttt_is_win_bits(uint16_t bits);
 /// Clear engine caches (transposition table).
 void ttt_reset_cache(void);
 
+/// Opaque engine cache (transposition table); one per thread for concurrent searches.
+typedef struct ttt_cache ttt_cache;
+
+/// Allocate an empty engine cache, or NULL on allocation failure.
+[[nodiscard]] ttt_cache* ttt_cache_create(void);
+
+/// Free a cache from ttt_cache_create() (NULL is allowed).
+void ttt_cache_destroy(ttt_cache* cache);
+
+/// Clear all entries of @p cache.
+void ttt_cache_reset(ttt_cache* cache);
+
+/// Like ttt_best_move(), but search with the caller-owned @p cache (reentrant across caches).
+[[nodiscard]] int ttt_best_move_with(ttt_cache* cache, Board board);
+
+/// @}
+
+/// @name Notakto (multi-board misère, X-only)
+/// Every player places X on any live board; completing three in a row kills that
+/// board, and whoever kills the last live board loses. Each board uses the X bits
+/// of a @ref Board (O bits and side bit stay zero).
+/// @{
+
+/// Element of the Notakto misère quotient monoid (opaque 6-bit code; 0 is the identity).
+typedef uint8_t ttt_nk_value;
+
+/// Place an X on @p square of Notakto board @p board (asserts the square is empty).
+static inline Board ttt_nk_apply(Board board, int square)
+{
+    assert(ttt_is_empty(board, square));
+    return board | (1u << square);
+}
+
+/// True if Notakto board @p board has three in a row (no further moves on it).
+static inline bool ttt_nk_is_dead(Board board) { return ttt_is_win_bits(ttt_bits_x(board)); }
+
+/// Quotient element of a single Notakto board (table lookup; dead boards map to the identity).
+ttt_nk_value ttt_nk_board_value(Board board);
+
+/// Product of two quotient elements.
+ttt_nk_value ttt_nk_mul(ttt_nk_value lhs, ttt_nk_value rhs);
+
+/// Quotient element of the whole position: product over all @p count boards.
+ttt_nk_value ttt_nk_value_of(const Board* boards, size_t count);
+
+/// True if @p value is a P-position (the player to move loses with perfect play).
+bool ttt_nk_is_p(ttt_nk_value value);
+
+/// True if every board in @p boards is dead (the player who just moved lost).
+bool ttt_nk_is_over(const Board* boards, size_t count);
+
+/**
+ * @brief Compute a perfect-play move for a Notakto position in O(@p count).
+ * @param boards    Array of @p count boards.
+ * @param count     Number of boards.
+ * @param out_board Receives the index of the board to play on.
+ * @return Square index 0..8, or -1 if every board is dead.
+ */
+[[nodiscard]] int ttt_nk_best_move(const Board* boards, size_t count, size_t* out_board);
+
 /// @}
 
 /// @name Utilities
@@ -1,7 +1,15 @@
+#define _DEFAULT_SOURCE // poll()
+
+#include "ttt_async.h"
 #include "ttt_engine.h"
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <threads.h>
+
+#if defined(__linux__)
+#include <poll.h>
+#endif
 
 // A simple assertion macro
 #define ASSERT(condition)                                                                                \
@@ -82,12 +90,279 @@ static bool test_move_parser(void)
     return true;
 }
 
+// Brute-force misère outcome of a two-board Notakto position: true if the player to move loses.
+static signed char nk_memo[1u << 9][1u << 9]; // 0 = unknown, 1 = P, -1 = N
+
+static bool nk_brute_is_p(uint16_t first, uint16_t second)
+{
+    if (nk_memo[first][second])
+        return nk_memo[first][second] > 0;
+    bool is_p = true;
+    uint16_t boards[2] = { first, second };
+    for (int i = 0; i < 2 && is_p; ++i) {
+        if (ttt_is_win_bits(boards[i]))
+            continue;
+        for (int sq = 0; sq < 9 && is_p; ++sq) {
+            if (boards[i] & (1u << sq))
+                continue;
+            uint16_t next[2] = { boards[0], boards[1] };
+            next[i] = (uint16_t)(next[i] | (1u << sq));
+            bool all_dead = ttt_is_win_bits(next[0]) && ttt_is_win_bits(next[1]);
+            // Killing the last board loses; otherwise win by reaching a P-position.
+            if (!all_dead && nk_brute_is_p(next[0], next[1]))
+                is_p = false;
+        }
+    }
+    nk_memo[first][second] = is_p ? 1 : -1;
+    return is_p;
+}
+
+static bool test_notakto_quotient(void)
+{
+    printf("Running test: %s\n", __func__);
+    for (uint16_t first = 0; first < 512; ++first) {
+        for (uint16_t second = 0; second < 512; ++second) {
+            if (ttt_is_win_bits(first) && ttt_is_win_bits(second))
+                continue;
+            Board boards[2] = { first, second };
+            ASSERT(ttt_nk_is_p(ttt_nk_value_of(boards, 2)) == nk_brute_is_p(first, second));
+        }
+    }
+    return true;
+}
+
+static bool test_notakto_self_play(void)
+{
+    printf("Running test: %s\n", __func__);
+    enum { N = 40 };
+    Board boards[N] = { 0 };
+    // The first player wins from a position that is not P, and must keep it that way.
+    bool first_wins = !ttt_nk_is_p(ttt_nk_value_of(boards, N));
+    int mover = 0;
+    int last_mover = -1;
+    while (!ttt_nk_is_over(boards, N)) {
+        size_t b = 0;
+        int sq = ttt_nk_best_move(boards, N, &b);
+        ASSERT(sq >= 0 && b < N);
+        bool winning = !ttt_nk_is_p(ttt_nk_value_of(boards, N));
+        boards[b] = ttt_nk_apply(boards[b], sq);
+        if (winning)
+            ASSERT(ttt_nk_is_over(boards, N) || ttt_nk_is_p(ttt_nk_value_of(boards, N)));
+        last_mover = mover;
+        mover ^= 1;
+    }
+    // Whoever killed the last board lost.
+    ASSERT((last_mover != 0) == first_wins);
+    return true;
+}
+
+// Completion bookkeeping shared by the async tests (callbacks run on this thread).
+typedef struct {
+    int expected; // move every successful job must return
+    int completed;
+    int cancelled;
+    int wrong;
+} AsyncTally;
+
+static void async_expect(ttt_job job, int move, int status, void* user_data)
+{
+    (void)job;
+    AsyncTally* tally = user_data;
+    ++tally->completed;
+    if (status == TTT_ASYNC_CANCELLED)
+        ++tally->cancelled;
+    else if (move != tally->expected)
+        ++tally->wrong;
+}
+
+// Per-job expectation for test_async_best_move (expected from a fresh cache).
+typedef struct {
+    Board board;
+    int expected;
+    int move;
+} AsyncCheck;
+
+static int async_records;
+
+static void async_record(ttt_job job, int move, int status, void* user_data)
+{
+    (void)job;
+    AsyncCheck* check = user_data;
+    check->move = status == TTT_ASYNC_OK ? move : TTT_ASYNC_CANCELLED;
+    ++async_records;
+}
+
+// Collect every reachable, non-terminal position within @p plies moves of @p board.
+static void collect_positions(Board board, int plies, bool* seen, AsyncCheck* out, size_t* count)
+{
+    if (seen[board] || ttt_is_terminal(board, NULL) || ttt_is_win_bits(ttt_bits_x(board)))
+        return;
+    seen[board] = true;
+    out[(*count)++] = (AsyncCheck) { .board = board };
+    if (plies == 0)
+        return;
+    for (int sq = 0; sq < 9; ++sq)
+        if (ttt_is_legal(board, sq))
+            collect_positions(ttt_apply(board, sq), plies - 1, seen, out, count);
+}
+
+static bool test_async_best_move(void)
+{
+    printf("Running test: %s\n", __func__);
+    enum { MAX_JOBS = 2048 };
+    static AsyncCheck checks[MAX_JOBS];
+    static bool seen[1u << 19];
+
+    // Known cache-poisoning pair first: "X a1, O to move" then "X a2, O c3, X to move".
+    size_t count = 0;
+    checks[count++] = (AsyncCheck) { .board = ttt_apply(ttt_initial(), A1) };
+    checks[count++] = (AsyncCheck) { .board = ttt_apply(ttt_apply(ttt_initial(), A2), C3) };
+    collect_positions(ttt_initial(), 4, seen, checks, &count);
+    ASSERT(count <= MAX_JOBS);
+
+    ttt_cache* fresh = ttt_cache_create();
+    ASSERT(fresh);
+    for (size_t i = 0; i < count; ++i) {
+        ttt_cache_reset(fresh);
+        checks[i].expected = ttt_best_move_with(fresh, checks[i].board);
+    }
+    ttt_cache_destroy(fresh);
+
+    async_records = 0;
+    ASSERT(ttt_async_init(4, 16) == TTT_ASYNC_OK);
+    for (size_t submitted = 0; submitted < count;) {
+        ttt_job job = ttt_submit_best_move(checks[submitted].board, async_record, &checks[submitted]);
+        if (job == TTT_ASYNC_FULL) {
+            ttt_async_poll(SIZE_MAX); // backpressure: drain, then retry
+            thrd_yield();
+            continue;
+        }
+        ASSERT(job > 0);
+        ++submitted;
+    }
+    while (async_records < (int)count) {
+        ttt_async_poll(SIZE_MAX);
+        thrd_yield();
+    }
+    ttt_async_shutdown();
+
+    for (size_t i = 0; i < count; ++i)
+        ASSERT(checks[i].move == checks[i].expected);
+    return true;
+}
+
+static bool test_async_backpressure_cancel(void)
+{
+    printf("Running test: %s\n", __func__);
+    AsyncTally tally = { .expected = ttt_best_move(ttt_initial()) };
+    ASSERT(ttt_async_init(1, 2) == TTT_ASYNC_OK);
+
+    // Slots are only recycled by polling, so the third submission must be refused.
+    ttt_job first = ttt_submit_best_move(ttt_initial(), async_expect, &tally);
+    ttt_job second = ttt_submit_best_move(ttt_initial(), async_expect, &tally);
+    ASSERT(first > 0 && second > 0 && first != second);
+    ASSERT(ttt_submit_best_move(ttt_initial(), async_expect, &tally) == TTT_ASYNC_FULL);
+
+    bool cancelled = ttt_cancel(second);
+    ASSERT(!ttt_cancel(second)); // at most once
+    while (tally.completed < 2) {
+        ttt_async_poll(SIZE_MAX);
+        thrd_yield();
+    }
+    ASSERT(tally.cancelled == (cancelled ? 1 : 0));
+    ASSERT(!ttt_cancel(first)); // finished jobs cannot be cancelled
+
+    // Shutdown delivers a callback for every outstanding job.
+    for (int i = 0; i < 2; ++i)
+        ASSERT(ttt_submit_best_move(ttt_initial(), async_expect, &tally) > 0);
+    ttt_async_shutdown();
+    ASSERT(tally.completed == 4);
+    ASSERT(tally.wrong == 0);
+    ASSERT(ttt_submit_best_move(ttt_initial(), async_expect, &tally) == TTT_ASYNC_NOT_RUNNING);
+    return true;
+}
+
+#if defined(__linux__)
+// True if @p fd becomes readable within @p timeout_ms.
+static bool fd_readable(int fd, int timeout_ms)
+{
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    return poll(&pfd, 1, timeout_ms) == 1 && (pfd.revents & POLLIN);
+}
+
+static bool test_async_eventfd(void)
+{
+    printf("Running test: %s\n", __func__);
+    Board t = ttt_initial();
+    t = ttt_apply(t, 0); // X
+    t = ttt_apply(t, 4); // O
+    t = ttt_apply(t, 1); // X; O must block on 2
+
+    AsyncTally tally = { .expected = 2 };
+    ASSERT(ttt_async_init(1, 4) == TTT_ASYNC_OK);
+    int fd = ttt_async_fd();
+    ASSERT(fd >= 0);
+    ASSERT(!fd_readable(fd, 0));
+
+    ASSERT(ttt_submit_best_move(t, async_expect, &tally) > 0);
+    ASSERT(ttt_submit_best_move(t, async_expect, &tally) > 0);
+    while (ttt_async_pending() < 2) // both completions queued, none dispatched yet
+        ASSERT(fd_readable(fd, 5000));
+
+    // A partial drain leaves the fd readable; a full drain clears it.
+    ASSERT(ttt_async_poll(1) == 1);
+    ASSERT(fd_readable(fd, 0));
+    ASSERT(ttt_async_poll(SIZE_MAX) == 1);
+    ASSERT(!fd_readable(fd, 0));
+
+    ttt_async_shutdown();
+    ASSERT(tally.completed == 2 && tally.wrong == 0);
+    return true;
+}
+#endif
+
+// Resubmits once from inside its callback; records what the resubmission returned.
+typedef struct {
+    AsyncTally tally;
+    ttt_job resubmitted;
+} ResubmitState;
+
+static void async_resubmit(ttt_job job, int move, int status, void* user_data)
+{
+    ResubmitState* state = user_data;
+    async_expect(job, move, status, &state->tally);
+    if (state->tally.completed == 1)
+        state->resubmitted = ttt_submit_best_move(ttt_initial(), async_resubmit, state);
+}
+
+static bool test_async_resubmit_during_shutdown(void)
+{
+    printf("Running test: %s\n", __func__);
+    ResubmitState state = { .tally = { .expected = ttt_best_move(ttt_initial()) } };
+    ASSERT(ttt_async_init(1, 4) == TTT_ASYNC_OK);
+    ASSERT(ttt_submit_best_move(ttt_initial(), async_resubmit, &state) > 0);
+
+    // Shutdown dispatches the callback; work submitted from it must be refused, not lost.
+    ttt_async_shutdown();
+    ASSERT(state.resubmitted == TTT_ASYNC_NOT_RUNNING);
+    ASSERT(state.tally.completed == 1);
+    return true;
+}
+
 // Array of tests to run
 static test_func tests[] = {
     test_draw,
     test_forced_win,
     test_win_conditions,
     test_move_parser,
+    test_notakto_quotient,
+    test_notakto_self_play,
+    test_async_best_move,
+    test_async_backpressure_cancel,
+#if defined(__linux__)
+    test_async_eventfd,
+#endif
+    test_async_resubmit_during_shutdown,
 };
 
 int main(void)